@@ -4,6 +4,8 @@
 #include <cassert>
 #include <algorithm>
 #include <utility>
+#include <limits>
+#include <mutex>
 
 template<class It>
 constexpr bool is_input_iterator_v = std::is_base_of<std::input_iterator_tag, typename It::iterator_category>::value;
@@ -27,6 +29,70 @@ struct Node {
 	}
 };
 
+// Collects node chains detached by XorList::clear() and friends and destroys them later, a bounded
+// number at a time, so that tearing down a large list does not stall the thread that requested it.
+// The allocator must compare equal to the allocators of the lists attached to the reclaimer.
+// Adopting chains and reclaiming may happen concurrently from different threads.
+template<class T, class Allocator = std::allocator<T>>
+class NodeReclaimer {
+	Node<T>* first = nullptr;
+	Node<T>* last = nullptr;
+	std::size_t pending_ = 0;
+	using node_alloc_t = typename std::allocator_traits<Allocator>::template rebind_traits<Node<T>>::allocator_type;
+	using node_alloc_traits = typename std::allocator_traits<node_alloc_t>;
+	node_alloc_t node_alloc;
+	mutable std::mutex mutex;
+	template<class, class> friend class XorList;
+	void adopt(Node<T>* head, Node<T>* tail, std::size_t count) { // head and tail have null outer siblings
+		const std::lock_guard<std::mutex> lock(mutex);
+		if (last) {
+			last->upd_sibling(nullptr, head);
+			head->upd_sibling(nullptr, last);
+		} else first = head;
+		last = tail;
+		pending_ += count;
+	}
+public:
+	explicit NodeReclaimer(const Allocator& alloc = Allocator()) : node_alloc(alloc) {}
+	NodeReclaimer(const NodeReclaimer&) = delete;
+	NodeReclaimer& operator=(const NodeReclaimer&) = delete;
+	~NodeReclaimer() { reclaim(); }
+	// Destroys and deallocates at most `budget` pending nodes; returns how many were reclaimed.
+	std::size_t reclaim(std::size_t budget = std::numeric_limits<std::size_t>::max()) {
+		Node<T>* head;
+		Node<T>* tail;
+		std::size_t count;
+		{ // take the whole chain so that adopt() is not blocked while nodes are being destroyed
+			const std::lock_guard<std::mutex> lock(mutex);
+			head = std::exchange(first, nullptr);
+			tail = std::exchange(last, nullptr);
+			count = std::exchange(pending_, 0);
+		}
+		std::size_t reclaimed = 0;
+		for (; head && reclaimed < budget; ++reclaimed) {
+			Node<T>* const next = head->get_complement(nullptr);
+			if (next) next->upd_sibling(head, nullptr);
+			node_alloc_traits::destroy(node_alloc, head);
+			node_alloc_traits::deallocate(node_alloc, head, 1);
+			head = next;
+		}
+		if (head) { // put the remainder back in front of whatever was adopted meanwhile
+			const std::lock_guard<std::mutex> lock(mutex);
+			if (first) {
+				tail->upd_sibling(nullptr, first);
+				first->upd_sibling(nullptr, tail);
+			} else last = tail;
+			first = head;
+			pending_ += count - reclaimed;
+		}
+		return reclaimed;
+	}
+	std::size_t pending() const {
+		const std::lock_guard<std::mutex> lock(mutex);
+		return pending_;
+	}
+};
+
 template<class T, class Allocator = std::allocator<T>>
 class XorList {
 	Node<T>* first = nullptr;
@@ -35,6 +101,7 @@ class XorList {
 	using node_alloc_t = typename std::allocator_traits<Allocator>::template rebind_traits<Node<T>>::allocator_type;
 	using node_alloc_traits = typename std::allocator_traits<node_alloc_t>;
 	node_alloc_t node_alloc;
+	NodeReclaimer<T, Allocator>* reclaimer = nullptr;
 	template<bool IsConst>
 	struct iterator_t {
 		using iterator_category = std::bidirectional_iterator_tag;
@@ -110,7 +177,8 @@ public:
 		: first(other.first)
 		, last(other.last)
 		, size_(other.size_)
-		, node_alloc(std::move(other.node_alloc)) {
+		, node_alloc(std::move(other.node_alloc))
+		, reclaimer(other.reclaimer) {
 		other.size_ = 0,
 		other.first = other.last = nullptr;
 	}
@@ -165,8 +233,10 @@ public:
 	void assign(InputIterator beg_in, InputIterator end_in) {
 		iterator out = begin();
 		InputIterator in = beg_in;
-		for (const iterator cont_end = end(); out != end() && in != end_in; *out++ = *in++) {}
+		std::size_t kept = 0;
+		for (const iterator cont_end = end(); out != end() && in != end_in; *out++ = *in++, ++kept) {}
 		if (out == end()) std::copy(in, end_in, std::back_inserter(*this));
+		else if (reclaimer) detach(out, kept);
 		else while (out != end()) out = erase(out);
 	}
 	template<class U>
@@ -191,11 +261,20 @@ public:
 		std::swap(first, other.first);
 		std::swap(last, other.last);
 		std::swap(size_, other.size_);
+		std::swap(reclaimer, other.reclaimer);
 		if constexpr(node_alloc_traits::propagate_on_container_swap::value) std::swap(node_alloc, other.node_alloc);
 	}
 	void pop_back() { erase(std::prev(end())); }
 	void pop_front() { erase(begin()); }
-	void clear() { for (auto it = begin(); it != end(); it = erase(it)) {} }
+	void clear() {
+		if (reclaimer) detach(begin(), 0);
+		else for (auto it = begin(); it != end(); it = erase(it)) {}
+	}
+	// While a reclaimer is set, clear(), the destructor and assign() shrinking the list hand the
+	// removed nodes over to it in O(1) instead of destroying them one by one. The reclaimer must
+	// outlive every such call.
+	void set_reclaimer(NodeReclaimer<T, Allocator>* r) { reclaimer = r; }
+	NodeReclaimer<T, Allocator>* get_reclaimer() const { return reclaimer; }
 	T& front() { return *begin(); }
 	T& back() { return *std::prev(end()); }
 	const T& front() const { return *begin(); }
@@ -213,4 +292,16 @@ public:
 	const_reverse_iterator crbegin() const { return rbegin(); }
 	const_reverse_iterator crend() const { return rend(); }
 	std::size_t size() const { return size_; }
+private:
+	void detach(iterator it, std::size_t kept) { // cuts [it, end()) off, leaving `kept` elements behind
+		if (it == end()) return;
+		Node<T>* const head = it.get_node();
+		Node<T>* const tail = last;
+		if (it != begin()) it.get_prev_node()->upd_sibling(head, nullptr);
+		else first = nullptr;
+		head->upd_sibling(it.get_prev_node(), nullptr);
+		last = it.get_prev_node();
+		reclaimer->adopt(head, tail, size_ - kept);
+		size_ = kept;
+	}
 };
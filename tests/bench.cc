@@ -0,0 +1,54 @@
+#include "XorList.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+// Latency of clear() on the calling thread, eager vs. deferred to a NodeReclaimer
+// drained by a background thread.
+// to build manually:
+// clang++ -std=c++17 -O2 -I../include bench.cc -lpthread
+
+using clock_type = std::chrono::steady_clock;
+
+template<class F>
+double p99_us(std::vector<double>& samples, std::size_t rounds, F&& round) {
+	samples.clear();
+	for (std::size_t i = 0; i < rounds; ++i) samples.push_back(round());
+	std::sort(samples.begin(), samples.end());
+	return samples[samples.size() * 99 / 100];
+}
+
+template<class List>
+double timed_clear(List& l, std::size_t size) {
+	for (std::size_t i = 0; i < size; ++i) l.push_back(int(i));
+	const auto start = clock_type::now();
+	l.clear();
+	return std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+}
+
+int main() {
+	NodeReclaimer<int> reclaimer;
+	std::atomic<bool> done = false;
+	std::thread background([&] {
+		while (!done) if (!reclaimer.reclaim(1 << 12)) std::this_thread::yield();
+	});
+
+	std::vector<double> samples;
+	std::printf("%10s %16s %16s\n", "size", "eager p99, us", "deferred p99, us");
+	for (std::size_t size = 1 << 10; size <= 1 << 22; size <<= 2) {
+		const std::size_t rounds = std::max<std::size_t>(20, (1 << 24) / size);
+		XorList<int> eager;
+		XorList<int> deferred;
+		deferred.set_reclaimer(&reclaimer);
+		const double eager_p99 = p99_us(samples, rounds, [&] { return timed_clear(eager, size); });
+		const double deferred_p99 = p99_us(samples, rounds, [&] { return timed_clear(deferred, size); });
+		std::printf("%10zu %16.2f %16.2f\n", size, eager_p99, deferred_p99);
+	}
+
+	done = true;
+	background.join();
+}
@@ -231,6 +231,57 @@ TEST(XorList, Clear) {
 	ASSERT_EQ(l.size(), 0);
 }
 
+TEST(XorList, DeferredClear) {
+	NodeReclaimer<int> r;
+	XorList<int> l{1,2,3,4,5};
+	l.set_reclaimer(&r);
+	auto first = ignore_access_rights::result<Node<int>* XorList<int>::*, 0>;
+	auto last = ignore_access_rights::result<Node<int>* XorList<int>::*, 1>;
+	l.clear();
+	ASSERT_EQ(l.*first, l.*last);
+	ASSERT_EQ(l.*last, nullptr);
+	ASSERT_EQ(l.size(), 0);
+	ASSERT_EQ(r.pending(), 5);
+	l.push_back(6);
+	ASSERT_EQ(l, (XorList<int>{6}));
+	ASSERT_EQ(r.reclaim(2), 2);
+	ASSERT_EQ(r.pending(), 3);
+	ASSERT_EQ(r.reclaim(), 3);
+	ASSERT_EQ(r.pending(), 0);
+}
+
+TEST(XorList, DeferredDtorAndAssign) {
+	NodeReclaimer<int> r;
+	{
+		XorList<int> l{1,2,3};
+		l.set_reclaimer(&r);
+	}
+	XorList<int> l{1,2,3,4,5};
+	l.set_reclaimer(&r);
+	const XorList<int> k{7,8};
+	l.assign(k.begin(), k.end());
+	ASSERT_EQ(l, k);
+	ASSERT_TRUE(std::equal(l.rbegin(), l.rend(), k.rbegin(), k.rend()));
+	ASSERT_EQ(r.pending(), 6);
+	r.reclaim(4);
+	l.clear();
+	ASSERT_EQ(r.pending(), 4);
+	ASSERT_EQ(r.reclaim(), 4);
+}
+
+TEST(XorList, DeferredReclaimDestroysElements) {
+	NodeReclaimer<std::shared_ptr<int>> r;
+	const auto p = std::make_shared<int>();
+	XorList<std::shared_ptr<int>> l(3, p);
+	l.set_reclaimer(&r);
+	l.clear();
+	ASSERT_EQ(p.use_count(), 4);
+	r.reclaim(1);
+	ASSERT_EQ(p.use_count(), 3);
+	r.reclaim();
+	ASSERT_EQ(p.use_count(), 1);
+}
+
 TEST(XorList, ReturnTypeCorrectness) {
 	using std::is_same_v;
 	XorList<int> l;